@@ -0,0 +1,172 @@
+#ifndef MATMUL_H
+#define MATMUL_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The library is built with hidden visibility; only declarations marked MATMUL_API are
+// exported from the shared object.
+#ifndef MATMUL_API
+#if defined(__GNUC__) && __GNUC__ >= 4
+#define MATMUL_API __attribute__((visibility("default")))
+#else
+#define MATMUL_API
+#endif
+#endif
+
+// Matrices are arrays of row pointers (int**), as returned by matmul_allocate.
+// The square engines expect n to be a power of two unless noted otherwise.
+//
+// Every matrix function takes its dimensions first, then its input matrices, then the
+// matrices it writes, then any options. Pool and cost-model functions take the object
+// they act on first.
+
+// --- Matrix Creation and Utilities ---
+
+MATMUL_API int** matmul_allocate_square(int dimension_n);
+MATMUL_API int** matmul_allocate(int rows, int cols);
+MATMUL_API void matmul_release(int rows, int** matrix);
+MATMUL_API void matmul_copy_square(int n, int** Source, int** Destination);
+MATMUL_API void matmul_add(int dimension_n, int** MatrixA, int** MatrixB, int** MatrixResult);
+MATMUL_API void matmul_subtract(int dimension_n, int** MatrixA, int** MatrixB, int** MatrixResult);
+MATMUL_API void matmul_print(int rows, int cols, int** matrix);
+
+// --- Operand Layout and Transpose Flags ---
+
+typedef enum { MATMUL_ROW_MAJOR = 0, MATMUL_COL_MAJOR = 1 } MatmulLayout;
+typedef enum { MATMUL_NO_TRANS = 0, MATMUL_TRANS = 1 } MatmulTranspose;
+
+// Destination (cols x rows) = Source (rows x cols)^T; Source and Destination must not alias.
+MATMUL_API void matmul_transpose(int rows, int cols, int** Source, int** Destination);
+MATMUL_API void matmul_transpose_in_place(int dimension_n, int** matrix);
+
+// --- Multiply Engines ---
+
+// Classical O(n^3); works for any n.
+MATMUL_API void matmul_standard(int n, int** MatrixA, int** MatrixB, int** MatrixC);
+MATMUL_API void matmul_standard_ex(int n, int** MatrixA, int** MatrixB, int** MatrixC,
+                                   MatmulLayout layout, MatmulTranspose transA, MatmulTranspose transB);
+
+// C (rows x cols) = A (rows x inner) * B (inner x cols), all row-major.
+MATMUL_API void matmul_rectangular(int rows, int inner, int cols, int** MatrixA, int** MatrixB, int** MatrixC);
+
+MATMUL_API void matmul_divide_and_conquer(int n, int** A, int** B, int** C);
+MATMUL_API void matmul_divide_and_conquer_ex(int n, int** A, int** B, int** C,
+                                             MatmulLayout layout, MatmulTranspose transA, MatmulTranspose transB);
+
+MATMUL_API void matmul_strassen(int n, int** A, int** B, int** C);
+MATMUL_API void matmul_strassen_ex(int n, int** A, int** B, int** C,
+                                   MatmulLayout layout, MatmulTranspose transA, MatmulTranspose transB);
+
+// C = A * B mod modulus for inputs already reduced into [0, modulus); works for any n.
+MATMUL_API void matmul_modular(int n, int** A, int** B, int** C, int modulus);
+
+// --- Workspace: Shared Buffer Pool ---
+
+// Opaque so its internals can change without breaking the library ABI. A pool may be
+// passed to matmul_chain and matmul_power to keep their scratch buffers across calls;
+// it is not thread-safe, so give each thread its own.
+typedef struct MatmulBufferPool MatmulBufferPool;
+
+MATMUL_API MatmulBufferPool* matmul_pool_create(void);
+// Returns a buffer of at least rows x cols; it stays owned by the pool.
+MATMUL_API int** matmul_pool_acquire(MatmulBufferPool* pool, int rows, int cols);
+MATMUL_API void matmul_pool_release(MatmulBufferPool* pool, int** matrix);
+// Frees the pool and every buffer it handed out.
+MATMUL_API void matmul_pool_destroy(MatmulBufferPool* pool);
+
+// --- Engine Cost Model ---
+
+typedef struct {
+    double seconds_per_mac;
+    double strassen_coefficient;
+} MatmulCostModel;
+
+MATMUL_API void matmul_calibrate_cost_model(MatmulCostModel* model);
+MATMUL_API double matmul_predict_seconds(const MatmulCostModel* model, int rows, int inner, int cols, int* use_strassen);
+
+// --- Matrix Chain Product ---
+
+#define MATMUL_CHAIN_MAX_LENGTH 64
+#define MATMUL_CHAIN_ORDER_LENGTH 512
+
+typedef struct {
+    char order[MATMUL_CHAIN_ORDER_LENGTH]; // e.g. "((A1 A2) A3)"
+    double predicted_seconds;
+    double actual_seconds;
+} MatmulChainReport;
+
+// Matrix i of the chain is dims[i] x dims[i + 1]. Returns 0 on success, -1 on a bad count.
+// model may be NULL: steps are then priced by scalar multiply count on the classical kernel.
+// pool may be NULL: intermediates then come from a pool private to this call.
+MATMUL_API int matmul_chain(int count, const int* dims, int*** matrices, int** Result,
+                            const MatmulCostModel* model, MatmulBufferPool* pool, MatmulChainReport* report);
+
+// --- Matrix Power ---
+
+// Result = A^exponent, reduced mod modulus when modulus > 0; model and pool may be NULL.
+MATMUL_API void matmul_power(int n, int** A, int** Result, unsigned long long exponent, int modulus,
+                             const MatmulCostModel* model, MatmulBufferPool* pool);
+
+// --- Incremental Product Updates ---
+
+// Refresh a cached C = A * B (A rows x inner, B inner x cols) after a small change to A or B.
+// Each returns 1 if the change fraction exceeded recompute_fraction and C was recomputed in
+// full, 0 if it was patched. Changed row/column lists may contain duplicates.
+#define MATMUL_UPDATE_RECOMPUTE_FRACTION 0.5
+
+MATMUL_API int matmul_update_rows(int rows, int inner, int cols, int** A, int** B, int** C,
+                                  const int* changed_rows, int count, double recompute_fraction);
+MATMUL_API int matmul_update_cols(int rows, int inner, int cols, int** A, int** B, int** C,
+                                  const int* changed_cols, int count, double recompute_fraction);
+// The rank-k updates also apply the change itself: _a does A += U * V^T (U rows x k,
+// V inner x k) and _b does B += U * V^T (U inner x k, V cols x k).
+MATMUL_API int matmul_update_rank_k_a(int rows, int inner, int cols, int** A, int** B, int** C,
+                                      int k, int** U, int** V, double recompute_fraction);
+MATMUL_API int matmul_update_rank_k_b(int rows, int inner, int cols, int** A, int** B, int** C,
+                                      int k, int** U, int** V, double recompute_fraction);
+
+// --- Random Matrix Generation ---
+
+typedef enum {
+    MATMUL_FILL_UNIFORM,  // every entry uniform in [low, high]
+    MATMUL_FILL_SPARSE,   // each entry is non-zero with probability density
+    MATMUL_FILL_IDENTITY, // ones on the diagonal, no randomness
+    MATMUL_FILL_BANDED    // uniform entries where |row - col| <= bandwidth, zero elsewhere
+} MatmulFillKind;
+
+typedef struct {
+    MatmulFillKind kind;
+    int low;
+    int high;
+    double density;
+    int bandwidth;
+} MatmulFillOptions;
+
+MATMUL_API MatmulFillOptions matmul_fill_uniform(int low, int high);
+MATMUL_API MatmulFillOptions matmul_fill_sparse(int low, int high, double density);
+MATMUL_API MatmulFillOptions matmul_fill_identity(void);
+MATMUL_API MatmulFillOptions matmul_fill_banded(int low, int high, int bandwidth);
+
+// Output depends only on (seed, stream, options), never on thread count. Streams from 2^63
+// up are reserved for matmul_freivalds_check. Returns 0 on success and -1 if high < low
+// for a random kind.
+MATMUL_API int matmul_fill_random(int rows, int cols, int** matrix, uint64_t seed, uint64_t stream,
+                                  const MatmulFillOptions* options);
+
+// --- Verification ---
+
+MATMUL_API void matmul_reference(int rows, int inner, int cols, int** A, int** B, int** C);
+
+// Returns 1 if C == A * B passed every trial; a wrong C survives with probability <= 2^-trials.
+MATMUL_API int matmul_freivalds_check(int rows, int inner, int cols, int** A, int** B, int** C,
+                                      int trials, uint64_t seed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef MATMUL_INTERNAL_H
+#define MATMUL_INTERNAL_H
+
+#include "matmul.h"
+
+// A matrix is an array of row pointers; in column-major layout matrix[j] holds column j.
+// Reading an operand transposed or column-major both just swap the two indices, so each
+// operand collapses to a single "swapped" bit and no transposed copy is ever built.
+static inline int operand_is_swapped(MatmulLayout layout, MatmulTranspose trans) {
+    return (layout == MATMUL_COL_MAJOR) != (trans == MATMUL_TRANS);
+}
+
+static inline int* matrix_element(int** matrix, int swapped, int row, int col) {
+    return swapped ? &matrix[col][row] : &matrix[row][col];
+}
+
+static inline int is_power_of_two(int n) {
+    return n > 0 && (n & (n - 1)) == 0;
+}
+
+// --- Philox4x32-10 ---
+
+#define PHILOX_M0 0xD2511F53u
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u
+#define PHILOX_W1 0xBB67AE85u
+
+// Runs the ten Philox4x32-10 rounds on counter in place under the key (key0, key1).
+static inline void philox4x32_10(uint32_t counter[4], uint32_t key0, uint32_t key1) {
+    uint32_t c0 = counter[0];
+    uint32_t c1 = counter[1];
+    uint32_t c2 = counter[2];
+    uint32_t c3 = counter[3];
+    for (int round = 0; round < 10; round++) {
+        uint64_t product0 = (uint64_t)PHILOX_M0 * c0;
+        uint64_t product1 = (uint64_t)PHILOX_M1 * c2;
+        uint32_t next0 = (uint32_t)(product1 >> 32) ^ c1 ^ key0;
+        uint32_t next2 = (uint32_t)(product0 >> 32) ^ c3 ^ key1;
+        c1 = (uint32_t)product1;
+        c3 = (uint32_t)product0;
+        c0 = next0;
+        c2 = next2;
+        key0 += PHILOX_W0;
+        key1 += PHILOX_W1;
+    }
+    counter[0] = c0;
+    counter[1] = c1;
+    counter[2] = c2;
+    counter[3] = c3;
+}
+
+#endif
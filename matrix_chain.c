@@ -0,0 +1,273 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include "matmul_internal.h"
+
+// --- Shared Buffer Pool for Intermediates ---
+
+typedef struct {
+    int** data;
+    int rows;
+    int cols;
+    int in_use;
+} PooledMatrix;
+
+struct MatmulBufferPool {
+    PooledMatrix* slots;
+    int count;
+    int capacity;
+};
+
+MatmulBufferPool* matmul_pool_create(void) {
+    MatmulBufferPool* pool = (MatmulBufferPool*)malloc(sizeof(MatmulBufferPool));
+    pool->slots = NULL;
+    pool->count = 0;
+    pool->capacity = 0;
+    return pool;
+}
+
+// Hands out a buffer of at least rows x cols, reusing the smallest free one that fits.
+// Buffers are only ever grown, so a long chain settles on a handful of allocations.
+int** matmul_pool_acquire(MatmulBufferPool* pool, int rows, int cols) {
+    int best = -1;
+    int grow = -1;
+    for (int i = 0; i < pool->count; i++) {
+        PooledMatrix* slot = &pool->slots[i];
+        if (slot->in_use) {
+            continue;
+        }
+        if (slot->rows >= rows && slot->cols >= cols) {
+            if (best < 0 || (long)slot->rows * slot->cols < (long)pool->slots[best].rows * pool->slots[best].cols) {
+                best = i;
+            }
+        } else if (grow < 0) {
+            grow = i;
+        }
+    }
+    
+    if (best < 0 && grow >= 0) {
+        // Replace a free buffer that is too small rather than adding another one
+        PooledMatrix* slot = &pool->slots[grow];
+        int new_rows = slot->rows > rows ? slot->rows : rows;
+        int new_cols = slot->cols > cols ? slot->cols : cols;
+        matmul_release(slot->rows, slot->data);
+        slot->data = matmul_allocate(new_rows, new_cols);
+        slot->rows = new_rows;
+        slot->cols = new_cols;
+        best = grow;
+    }
+    
+    if (best < 0) {
+        if (pool->count == pool->capacity) {
+            pool->capacity = pool->capacity ? pool->capacity * 2 : 4;
+            pool->slots = (PooledMatrix*)realloc(pool->slots, pool->capacity * sizeof(PooledMatrix));
+        }
+        best = pool->count++;
+        pool->slots[best].data = matmul_allocate(rows, cols);
+        pool->slots[best].rows = rows;
+        pool->slots[best].cols = cols;
+    }
+    
+    pool->slots[best].in_use = 1;
+    return pool->slots[best].data;
+}
+
+void matmul_pool_release(MatmulBufferPool* pool, int** matrix) {
+    for (int i = 0; i < pool->count; i++) {
+        if (pool->slots[i].data == matrix) {
+            pool->slots[i].in_use = 0;
+            return;
+        }
+    }
+}
+
+void matmul_pool_destroy(MatmulBufferPool* pool) {
+    for (int i = 0; i < pool->count; i++) {
+        matmul_release(pool->slots[i].rows, pool->slots[i].data);
+    }
+    free(pool->slots);
+    free(pool);
+}
+
+// --- Engine Cost Model ---
+
+// Predicted time of one product, fitted from timing the engines on this machine:
+// classical = seconds_per_mac * rows * inner * cols, Strassen = strassen_coefficient * n^log2(7).
+
+#define COST_MODEL_CALIBRATION_SIZE 64
+#define COST_MODEL_MIN_SECONDS 0.02
+
+static double strassen_work(int n) {
+    return pow((double)n, log2(7.0));
+}
+
+void matmul_calibrate_cost_model(MatmulCostModel* model) {
+    int n = COST_MODEL_CALIBRATION_SIZE;
+    int **A = matmul_allocate_square(n);
+    int **B = matmul_allocate_square(n);
+    int **C = matmul_allocate_square(n);
+    for (int row = 0; row < n; row++) {
+        for (int col = 0; col < n; col++) {
+            A[row][col] = (row + col) % 100;
+            B[row][col] = (row * col) % 100;
+        }
+    }
+    
+    // Repeat each engine until the total is well above clock() resolution
+    int reps = 0;
+    clock_t start = clock();
+    do {
+        matmul_rectangular(n, n, n, A, B, C);
+        reps++;
+    } while ((double)(clock() - start) / CLOCKS_PER_SEC < COST_MODEL_MIN_SECONDS);
+    double classical_seconds = (double)(clock() - start) / CLOCKS_PER_SEC / reps;
+    
+    reps = 0;
+    start = clock();
+    do {
+        matmul_strassen(n, A, B, C);
+        reps++;
+    } while ((double)(clock() - start) / CLOCKS_PER_SEC < COST_MODEL_MIN_SECONDS);
+    double strassen_seconds = (double)(clock() - start) / CLOCKS_PER_SEC / reps;
+    
+    model->seconds_per_mac = classical_seconds / ((double)n * n * n);
+    model->strassen_coefficient = strassen_seconds / strassen_work(n);
+    
+    matmul_release(n, A);
+    matmul_release(n, B);
+    matmul_release(n, C);
+}
+
+// Returns the predicted seconds for the cheapest engine able to do this product and
+// reports through use_strassen whether that engine is Strassen (square power-of-two only).
+double matmul_predict_seconds(const MatmulCostModel* model, int rows, int inner, int cols, int* use_strassen) {
+    double classical = model->seconds_per_mac * (double)rows * inner * cols;
+    *use_strassen = 0;
+    if (rows == inner && inner == cols && is_power_of_two(rows)) {
+        double strassen = model->strassen_coefficient * strassen_work(rows);
+        if (strassen < classical) {
+            *use_strassen = 1;
+            return strassen;
+        }
+    }
+    return classical;
+}
+
+// --- Matrix Chain Product ---
+
+typedef struct {
+    const int* dims;
+    int*** matrices;
+    int count;
+    int* split;            // split[i * count + j]: last product of A(i..j) is A(i..s) * A(s+1..j)
+    int* use_strassen;     // engine chosen for that last product
+    MatmulBufferPool* pool;
+} MatrixChainPlan;
+
+static void format_chain_order(const MatrixChainPlan* plan, int i, int j, char* out, size_t* length) {
+    if (i == j) {
+        *length += snprintf(out + *length, MATMUL_CHAIN_ORDER_LENGTH - *length, "A%d", i + 1);
+        return;
+    }
+    int s = plan->split[i * plan->count + j];
+    *length += snprintf(out + *length, MATMUL_CHAIN_ORDER_LENGTH - *length, "(");
+    format_chain_order(plan, i, s, out, length);
+    *length += snprintf(out + *length, MATMUL_CHAIN_ORDER_LENGTH - *length, " ");
+    format_chain_order(plan, s + 1, j, out, length);
+    *length += snprintf(out + *length, MATMUL_CHAIN_ORDER_LENGTH - *length, ")");
+}
+
+// Computes A(i..j) into Destination, or into a pooled buffer when Destination is NULL.
+static int** execute_chain(MatrixChainPlan* plan, int i, int j, int** Destination) {
+    if (i == j) {
+        return plan->matrices[i];
+    }
+    int s = plan->split[i * plan->count + j];
+    int rows = plan->dims[i];
+    int inner = plan->dims[s + 1];
+    int cols = plan->dims[j + 1];
+    
+    int** Left = execute_chain(plan, i, s, NULL);
+    int** Right = execute_chain(plan, s + 1, j, NULL);
+    int** Product = Destination ? Destination : matmul_pool_acquire(plan->pool, rows, cols);
+    
+    if (plan->use_strassen[i * plan->count + j]) {
+        matmul_strassen(rows, Left, Right, Product);
+    } else {
+        matmul_rectangular(rows, inner, cols, Left, Right, Product);
+    }
+    
+    // Inputs come straight from the caller, so releasing them is a no-op
+    matmul_pool_release(plan->pool, Left);
+    matmul_pool_release(plan->pool, Right);
+    return Product;
+}
+
+// Result (dims[0] x dims[count]) = matrices[0] * ... * matrices[count - 1], where matrix i
+// is dims[i] x dims[i + 1]. The parenthesisation minimises the cost model's predicted time
+// rather than the scalar multiply count, so square power-of-two steps may go to Strassen.
+// With no model the plan falls back to scalar multiply counts on the classical kernel and
+// predicted_seconds is reported as 0. Intermediates come from pool, which the caller can
+// keep across chains so repeated calls stop allocating; NULL uses a private pool for this
+// call. Returns 0 on success and -1 if the chain is empty or too long.
+int matmul_chain(int count, const int* dims, int*** matrices, int** Result,
+                 const MatmulCostModel* model, MatmulBufferPool* pool, MatmulChainReport* report) {
+    if (count < 1 || count > MATMUL_CHAIN_MAX_LENGTH) {
+        return -1;
+    }
+    
+    MatrixChainPlan plan;
+    plan.dims = dims;
+    plan.matrices = matrices;
+    plan.count = count;
+    plan.split = (int*)calloc(count * count, sizeof(int));
+    plan.use_strassen = (int*)calloc(count * count, sizeof(int));
+    double* cost = (double*)calloc(count * count, sizeof(double));
+    plan.pool = pool ? pool : matmul_pool_create();
+    
+    // Classic matrix-chain DP over increasing sub-chain lengths
+    for (int length = 2; length <= count; length++) {
+        for (int i = 0; i + length - 1 < count; i++) {
+            int j = i + length - 1;
+            cost[i * count + j] = -1.0;
+            for (int s = i; s < j; s++) {
+                int strassen = 0;
+                double step = model ? matmul_predict_seconds(model, dims[i], dims[s + 1], dims[j + 1], &strassen)
+                                    : (double)dims[i] * dims[s + 1] * dims[j + 1];
+                double total = cost[i * count + s] + cost[(s + 1) * count + j] + step;
+                if (cost[i * count + j] < 0.0 || total < cost[i * count + j]) {
+                    cost[i * count + j] = total;
+                    plan.split[i * count + j] = s;
+                    plan.use_strassen[i * count + j] = strassen;
+                }
+            }
+        }
+    }
+    
+    clock_t start = clock();
+    if (count == 1) {
+        for (int row = 0; row < dims[0]; row++) {
+            memcpy(Result[row], matrices[0][row], dims[1] * sizeof(int));
+        }
+    } else {
+        execute_chain(&plan, 0, count - 1, Result);
+    }
+    clock_t end = clock();
+    
+    if (report) {
+        size_t length = 0;
+        format_chain_order(&plan, 0, count - 1, report->order, &length);
+        report->predicted_seconds = model ? cost[count - 1] : 0.0;
+        report->actual_seconds = ((double)(end - start)) / CLOCKS_PER_SEC;
+    }
+    
+    if (!pool) {
+        matmul_pool_destroy(plan.pool);
+    }
+    free(plan.split);
+    free(plan.use_strassen);
+    free(cost);
+    return 0;
+}
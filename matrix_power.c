@@ -0,0 +1,89 @@
+#include <stdlib.h>
+#include "matmul.h"
+
+// --- Matrix Power by Repeated Squaring ---
+
+// Result = A^exponent, or A^exponent mod modulus when modulus > 0 so large powers never
+// overflow int. Uses binary exponentiation over two scratch buffers allocated once and
+// ping-ponged with Result, so no matrix is allocated per multiply. Plain mode picks
+// Strassen or the classical kernel per the cost model (classical when model is NULL);
+// modular mode always uses matmul_modular. The scratch buffers come from pool when one
+// is given, so repeated powers reuse them, and are allocated for this call when it is
+// NULL. Result must not alias A.
+void matmul_power(int n, int** A, int** Result, unsigned long long exponent, int modulus,
+                  const MatmulCostModel* model, MatmulBufferPool* pool) {
+    MatmulBufferPool* scratch_pool = pool ? pool : matmul_pool_create();
+    int** Base = matmul_pool_acquire(scratch_pool, n, n);
+    int** Scratch = matmul_pool_acquire(scratch_pool, n, n);
+    int** Current = Result;
+    int current_is_identity = 1;
+    
+    int use_strassen = 0;
+    if (modulus <= 0 && model) {
+        matmul_predict_seconds(model, n, n, n, &use_strassen);
+    }
+    
+    for (int row = 0; row < n; row++) {
+        for (int col = 0; col < n; col++) {
+            int value = A[row][col];
+            if (modulus > 0) {
+                value %= modulus;
+                if (value < 0) {
+                    value += modulus;
+                }
+            }
+            Base[row][col] = value;
+        }
+    }
+    
+    while (exponent > 0) {
+        if (exponent & 1) {
+            if (current_is_identity) {
+                matmul_copy_square(n, Base, Current);
+                current_is_identity = 0;
+            } else {
+                if (modulus > 0) {
+                    matmul_modular(n, Current, Base, Scratch, modulus);
+                } else if (use_strassen) {
+                    matmul_strassen(n, Current, Base, Scratch);
+                } else {
+                    matmul_rectangular(n, n, n, Current, Base, Scratch);
+                }
+                int** swap = Current; Current = Scratch; Scratch = swap;
+            }
+        }
+        exponent >>= 1;
+        if (exponent > 0) {
+            if (modulus > 0) {
+                matmul_modular(n, Base, Base, Scratch, modulus);
+            } else if (use_strassen) {
+                matmul_strassen(n, Base, Base, Scratch);
+            } else {
+                matmul_rectangular(n, n, n, Base, Base, Scratch);
+            }
+            int** swap = Base; Base = Scratch; Scratch = swap;
+        }
+    }
+    
+    if (current_is_identity) {
+        for (int row = 0; row < n; row++) {
+            for (int col = 0; col < n; col++) {
+                Result[row][col] = (row == col) ? (modulus == 1 ? 0 : 1) : 0;
+            }
+        }
+    } else if (Current != Result) {
+        // The final product landed in a scratch buffer; hand that buffer back to the pool
+        matmul_copy_square(n, Current, Result);
+        if (Base == Result) {
+            Base = Current;
+        } else {
+            Scratch = Current;
+        }
+    }
+    
+    matmul_pool_release(scratch_pool, Base);
+    matmul_pool_release(scratch_pool, Scratch);
+    if (!pool) {
+        matmul_pool_destroy(scratch_pool);
+    }
+}
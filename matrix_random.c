@@ -0,0 +1,119 @@
+#include <stdint.h>
+#include "matmul_internal.h"
+
+// --- Counter-Based Random Matrix Generation ---
+//
+// Every element is produced by Philox4x32-10 from (seed, stream, element index) alone, so
+// there is no generator state to share: rows can be filled in any order or in parallel and
+// a given seed always yields the same matrix, whatever the thread count. Use a different
+// stream per matrix (e.g. A and B of one iteration) to get independent inputs.
+
+#define FILL_CHUNK 64
+
+// Runs Philox4x32-10 for the count consecutive element indices starting at first_index and
+// keeps the first two output words of each. Every lane is independent 32-bit arithmetic
+// plus a widening 32x32->64 multiply, which the compiler vectorises at -O3 even on
+// baseline x86-64 (SSE2); wider targets via MATMUL_ENABLE_NATIVE get wider vectors.
+static void philox_draws(int count, uint64_t first_index, uint64_t stream, uint32_t key0, uint32_t key1,
+                         uint32_t* restrict draw0, uint32_t* restrict draw1) {
+    uint32_t index_lo = (uint32_t)first_index;
+    uint32_t index_hi = (uint32_t)(first_index >> 32);
+    for (int t = 0; t < count; t++) {
+        uint32_t counter[4];
+        counter[0] = index_lo + (uint32_t)t;
+        counter[1] = index_hi + (counter[0] < index_lo); // carry into the high counter word
+        counter[2] = (uint32_t)stream;
+        counter[3] = (uint32_t)(stream >> 32);
+        philox4x32_10(counter, key0, key1);
+        draw0[t] = counter[0];
+        draw1[t] = counter[1];
+    }
+}
+
+MatmulFillOptions matmul_fill_uniform(int low, int high) {
+    MatmulFillOptions options = { MATMUL_FILL_UNIFORM, low, high, 1.0, 0 };
+    return options;
+}
+
+MatmulFillOptions matmul_fill_sparse(int low, int high, double density) {
+    MatmulFillOptions options = { MATMUL_FILL_SPARSE, low, high, density, 0 };
+    return options;
+}
+
+MatmulFillOptions matmul_fill_identity(void) {
+    MatmulFillOptions options = { MATMUL_FILL_IDENTITY, 0, 1, 1.0, 0 };
+    return options;
+}
+
+MatmulFillOptions matmul_fill_banded(int low, int high, int bandwidth) {
+    MatmulFillOptions options = { MATMUL_FILL_BANDED, low, high, 1.0, bandwidth };
+    return options;
+}
+
+// Fills a rows x cols matrix according to options. The fill kind is resolved once per
+// chunk, so the per-element loops are straight-line code; rows are split across threads
+// under OpenMP. Returns 0 on success and -1, leaving matrix untouched, if high < low.
+int matmul_fill_random(int rows, int cols, int** matrix, uint64_t seed, uint64_t stream,
+                       const MatmulFillOptions* options) {
+    if (options->kind != MATMUL_FILL_IDENTITY && options->high < options->low) {
+        return -1;
+    }
+    uint64_t span = (uint64_t)((int64_t)options->high - options->low + 1);
+    int full_range = (span == ((uint64_t)1 << 32));
+    uint32_t span32 = (uint32_t)span;
+    uint32_t low = (uint32_t)options->low;
+    // Threshold on a 32-bit draw; density >= 1.0 keeps every entry
+    int keep_all = (options->density >= 1.0);
+    uint32_t keep_below = keep_all ? 0 : (uint32_t)(options->density > 0.0 ? options->density * 4294967296.0 : 0.0);
+    uint32_t key0 = (uint32_t)seed;
+    uint32_t key1 = (uint32_t)(seed >> 32);
+
+    if (options->kind == MATMUL_FILL_IDENTITY) {
+        for (int row = 0; row < rows; row++) {
+            for (int col = 0; col < cols; col++) {
+                matrix[row][col] = (row == col);
+            }
+        }
+        return 0;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if ((int64_t)rows * cols >= 65536)
+#endif
+    for (int row = 0; row < rows; row++) {
+        int* out = matrix[row];
+        int first = 0;
+        int last = cols;
+        if (options->kind == MATMUL_FILL_BANDED) {
+            first = row - options->bandwidth > 0 ? row - options->bandwidth : 0;
+            last = row + options->bandwidth + 1 < cols ? row + options->bandwidth + 1 : cols;
+            for (int col = 0; col < cols; col++) {
+                out[col] = 0;
+            }
+        }
+
+        uint32_t draw0[FILL_CHUNK];
+        uint32_t draw1[FILL_CHUNK];
+        for (int start = first; start < last; start += FILL_CHUNK) {
+            int count = last - start < FILL_CHUNK ? last - start : FILL_CHUNK;
+            philox_draws(count, (uint64_t)row * (uint64_t)cols + (uint64_t)start, stream, key0, key1, draw0, draw1);
+
+            // Map each draw into [low, high] by the high half of draw * span
+            if (full_range) {
+                for (int t = 0; t < count; t++) {
+                    out[start + t] = (int)(low + draw0[t]);
+                }
+            } else {
+                for (int t = 0; t < count; t++) {
+                    out[start + t] = (int)(low + (uint32_t)(((uint64_t)draw0[t] * span32) >> 32));
+                }
+            }
+            if (options->kind == MATMUL_FILL_SPARSE && !keep_all) {
+                for (int t = 0; t < count; t++) {
+                    out[start + t] = draw1[t] < keep_below ? out[start + t] : 0;
+                }
+            }
+        }
+    }
+    return 0;
+}
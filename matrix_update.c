@@ -0,0 +1,142 @@
+#include <stdlib.h>
+#include "matmul.h"
+
+// --- Incremental Product Updates ---
+//
+// Each update patches a cached C = A * B (A rows x inner, B inner x cols) after a small
+// change, doing O(change * n^2) work instead of the O(n^3) full product. Once the changed
+// fraction exceeds recompute_fraction the whole product is redone with the classical
+// kernel, which walks memory better than many scattered patches. Each call returns 1 if
+// it fell back to a full recompute and 0 if it patched C in place.
+
+// Rows changed_rows[0..count) of A were modified: only those rows of C depend on them.
+int matmul_update_rows(int rows, int inner, int cols, int** A, int** B, int** C,
+                       const int* changed_rows, int count, double recompute_fraction) {
+    if ((double)count / rows > recompute_fraction) {
+        matmul_rectangular(rows, inner, cols, A, B, C);
+        return 1;
+    }
+    for (int c = 0; c < count; c++) {
+        int i = changed_rows[c];
+        // A row-pointer matrix offset by i is a 1 x inner matrix holding just row i
+        matmul_rectangular(1, inner, cols, &A[i], B, &C[i]);
+    }
+    return 0;
+}
+
+// Columns changed_cols[0..count) of B were modified: only those columns of C depend on them.
+// The changed columns are gathered into one flat inner x count block and multiplied by A in
+// the classical kernel's i-k-j order, so A is read once however many columns changed.
+// Listing a column more than once just recomputes it again.
+int matmul_update_cols(int rows, int inner, int cols, int** A, int** B, int** C,
+                       const int* changed_cols, int count, double recompute_fraction) {
+    if ((double)count / cols > recompute_fraction) {
+        matmul_rectangular(rows, inner, cols, A, B, C);
+        return 1;
+    }
+    int* gathered = (int*)malloc((size_t)inner * count * sizeof(int));
+    int* row = (int*)malloc(count * sizeof(int));
+    for (int k = 0; k < inner; k++) {
+        for (int c = 0; c < count; c++) {
+            gathered[(size_t)k * count + c] = B[k][changed_cols[c]];
+        }
+    }
+    for (int i = 0; i < rows; i++) {
+        for (int c = 0; c < count; c++) {
+            row[c] = 0;
+        }
+        for (int k = 0; k < inner; k++) {
+            int a_ik = A[i][k];
+            const int* gathered_k = &gathered[(size_t)k * count];
+            for (int c = 0; c < count; c++) {
+                row[c] += a_ik * gathered_k[c];
+            }
+        }
+        for (int c = 0; c < count; c++) {
+            C[i][changed_cols[c]] = row[c];
+        }
+    }
+    free(gathered);
+    free(row);
+    return 0;
+}
+
+// Applies A += U * V^T (U rows x k, V inner x k) and patches C += U * (V^T * B).
+// The patch costs k * (inner + rows) * cols against rows * inner * cols for a full
+// product, so its change fraction is k / rows + k / inner.
+int matmul_update_rank_k_a(int rows, int inner, int cols, int** A, int** B, int** C,
+                           int k, int** U, int** V, double recompute_fraction) {
+    for (int i = 0; i < rows; i++) {
+        for (int t = 0; t < k; t++) {
+            int u_it = U[i][t];
+            for (int q = 0; q < inner; q++) {
+                A[i][q] += u_it * V[q][t];
+            }
+        }
+    }
+    
+    if ((double)k / rows + (double)k / inner > recompute_fraction) {
+        matmul_rectangular(rows, inner, cols, A, B, C);
+        return 1;
+    }
+    
+    // W (k x cols) = V^T * B, then C += U * W
+    int** W = matmul_allocate(k, cols);
+    for (int t = 0; t < k; t++) {
+        for (int j = 0; j < cols; j++) {
+            W[t][j] = 0;
+        }
+    }
+    for (int q = 0; q < inner; q++) {
+        for (int t = 0; t < k; t++) {
+            int v_qt = V[q][t];
+            for (int j = 0; j < cols; j++) {
+                W[t][j] += v_qt * B[q][j];
+            }
+        }
+    }
+    for (int i = 0; i < rows; i++) {
+        for (int t = 0; t < k; t++) {
+            int u_it = U[i][t];
+            for (int j = 0; j < cols; j++) {
+                C[i][j] += u_it * W[t][j];
+            }
+        }
+    }
+    matmul_release(k, W);
+    return 0;
+}
+
+// Applies B += U * V^T (U inner x k, V cols x k) and patches C += (A * U) * V^T, the
+// mirror of the A-side update; its change fraction is k / cols + k / inner.
+int matmul_update_rank_k_b(int rows, int inner, int cols, int** A, int** B, int** C,
+                           int k, int** U, int** V, double recompute_fraction) {
+    for (int q = 0; q < inner; q++) {
+        for (int t = 0; t < k; t++) {
+            int u_qt = U[q][t];
+            for (int j = 0; j < cols; j++) {
+                B[q][j] += u_qt * V[j][t];
+            }
+        }
+    }
+    
+    if ((double)k / cols + (double)k / inner > recompute_fraction) {
+        matmul_rectangular(rows, inner, cols, A, B, C);
+        return 1;
+    }
+    
+    // W (rows x k) = A * U, then C += W * V^T; rows of W and V are both contiguous in t
+    int** W = matmul_allocate(rows, k);
+    matmul_rectangular(rows, inner, k, A, U, W);
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            int sum = 0;
+            for (int t = 0; t < k; t++) {
+                sum += W[i][t] * V[j][t];
+            }
+            C[i][j] += sum;
+        }
+    }
+    matmul_release(rows, W);
+    return 0;
+}
@@ -0,0 +1,182 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "matmul.h"
+
+// --- Core Matrix Utilities ---
+
+int** matmul_allocate_square(int dimension_n) {
+    int** matrix = (int**)malloc(dimension_n * sizeof(int*));
+    for (int i = 0; i < dimension_n; i++) {
+        matrix[i] = (int*)malloc(dimension_n * sizeof(int));
+    }
+    return matrix;
+}
+
+int** matmul_allocate(int rows, int cols) {
+    int** matrix = (int**)malloc(rows * sizeof(int*));
+    for (int i = 0; i < rows; i++) {
+        matrix[i] = (int*)malloc(cols * sizeof(int));
+    }
+    return matrix;
+}
+
+void matmul_release(int dimension_n, int** matrix) {
+    for (int i = 0; i < dimension_n; i++) {
+        free(matrix[i]);
+    }
+    free(matrix);
+}
+
+void matmul_add(int dimension_n, int** MatrixA, int** MatrixB, int** MatrixResult) {
+    for (int i = 0; i < dimension_n; i++) {
+        for (int j = 0; j < dimension_n; j++) {
+            MatrixResult[i][j] = MatrixA[i][j] + MatrixB[i][j];
+        }
+    }
+}
+
+void matmul_subtract(int dimension_n, int **MatrixA, int **MatrixB, int **MatrixResult) {
+    for (int i = 0; i < dimension_n; i++) {
+        for (int j = 0; j < dimension_n; j++) {
+            MatrixResult[i][j] = MatrixA[i][j] - MatrixB[i][j];
+        }
+    }
+}
+
+void matmul_print(int rows, int cols, int** matrix) {
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            printf("%d ", matrix[i][j]);
+        }
+        printf("\n");
+    }
+}
+
+void matmul_copy_square(int n, int** Source, int** Destination) {
+    for (int row = 0; row < n; row++) {
+        memcpy(Destination[row], Source[row], n * sizeof(int));
+    }
+}
+
+// --- Cache-Blocked Transpose ---
+
+#define TRANSPOSE_BLOCK_SIZE 32
+
+// Every row is contiguous, so a 4x4 block is four loads from four source rows and four
+// stores into four destination rows; the shuffle happens in registers with SSE2 unpacks.
+// Without SSE2 the same blocks are moved element by element.
+#if defined(__SSE2__)
+#include <emmintrin.h>
+
+typedef struct { __m128i row[4]; } Block4x4;
+
+// Loads the 4x4 block at (row, col) already transposed.
+static inline Block4x4 load_transposed_4x4(int** matrix, int row, int col) {
+    __m128i r0 = _mm_loadu_si128((const __m128i*)&matrix[row][col]);
+    __m128i r1 = _mm_loadu_si128((const __m128i*)&matrix[row + 1][col]);
+    __m128i r2 = _mm_loadu_si128((const __m128i*)&matrix[row + 2][col]);
+    __m128i r3 = _mm_loadu_si128((const __m128i*)&matrix[row + 3][col]);
+    __m128i t0 = _mm_unpacklo_epi32(r0, r1); // a0 b0 a1 b1
+    __m128i t1 = _mm_unpacklo_epi32(r2, r3); // c0 d0 c1 d1
+    __m128i t2 = _mm_unpackhi_epi32(r0, r1); // a2 b2 a3 b3
+    __m128i t3 = _mm_unpackhi_epi32(r2, r3); // c2 d2 c3 d3
+    Block4x4 block;
+    block.row[0] = _mm_unpacklo_epi64(t0, t1);
+    block.row[1] = _mm_unpackhi_epi64(t0, t1);
+    block.row[2] = _mm_unpacklo_epi64(t2, t3);
+    block.row[3] = _mm_unpackhi_epi64(t2, t3);
+    return block;
+}
+
+static inline void store_block_4x4(int** matrix, int row, int col, Block4x4 block) {
+    for (int i = 0; i < 4; i++) {
+        _mm_storeu_si128((__m128i*)&matrix[row + i][col], block.row[i]);
+    }
+}
+#else
+typedef struct { int row[4][4]; } Block4x4;
+
+static inline Block4x4 load_transposed_4x4(int** matrix, int row, int col) {
+    Block4x4 block;
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            block.row[j][i] = matrix[row + i][col + j];
+        }
+    }
+    return block;
+}
+
+static inline void store_block_4x4(int** matrix, int row, int col, Block4x4 block) {
+    for (int i = 0; i < 4; i++) {
+        memcpy(&matrix[row + i][col], block.row[i], 4 * sizeof(int));
+    }
+}
+#endif
+
+// Destination (cols x rows) = Source (rows x cols)^T. Works tile by tile so both the rows
+// read and the rows written stay in cache, with 4x4 register blocks inside each tile and
+// scalar copies for the ragged edges; Source and Destination must not alias.
+void matmul_transpose(int rows, int cols, int** Source, int** Destination) {
+    for (int bi = 0; bi < rows; bi += TRANSPOSE_BLOCK_SIZE) {
+        int i_end = bi + TRANSPOSE_BLOCK_SIZE < rows ? bi + TRANSPOSE_BLOCK_SIZE : rows;
+        for (int bj = 0; bj < cols; bj += TRANSPOSE_BLOCK_SIZE) {
+            int j_end = bj + TRANSPOSE_BLOCK_SIZE < cols ? bj + TRANSPOSE_BLOCK_SIZE : cols;
+            int i = bi;
+            for (; i + 4 <= i_end; i += 4) {
+                int j = bj;
+                for (; j + 4 <= j_end; j += 4) {
+                    store_block_4x4(Destination, j, i, load_transposed_4x4(Source, i, j));
+                }
+                for (; j < j_end; j++) {
+                    for (int r = i; r < i + 4; r++) {
+                        Destination[j][r] = Source[r][j];
+                    }
+                }
+            }
+            for (; i < i_end; i++) {
+                for (int j = bj; j < j_end; j++) {
+                    Destination[j][i] = Source[i][j];
+                }
+            }
+        }
+    }
+}
+
+// matrix = matrix^T without a second buffer: each tile on or above the diagonal is
+// swapped with its mirror tile below it, 4x4 block by 4x4 block. Both blocks of a pair
+// are loaded before either is stored, so a block on the diagonal transposes onto itself.
+void matmul_transpose_in_place(int dimension_n, int** matrix) {
+    for (int bi = 0; bi < dimension_n; bi += TRANSPOSE_BLOCK_SIZE) {
+        int i_end = bi + TRANSPOSE_BLOCK_SIZE < dimension_n ? bi + TRANSPOSE_BLOCK_SIZE : dimension_n;
+        for (int bj = bi; bj < dimension_n; bj += TRANSPOSE_BLOCK_SIZE) {
+            int j_end = bj + TRANSPOSE_BLOCK_SIZE < dimension_n ? bj + TRANSPOSE_BLOCK_SIZE : dimension_n;
+            int i = bi;
+            for (; i + 4 <= i_end; i += 4) {
+                // On a diagonal tile only blocks from the diagonal rightwards are swapped
+                int j = (bi == bj) ? i : bj;
+                for (; j + 4 <= j_end; j += 4) {
+                    Block4x4 upper = load_transposed_4x4(matrix, i, j);
+                    Block4x4 lower = load_transposed_4x4(matrix, j, i);
+                    store_block_4x4(matrix, j, i, upper);
+                    store_block_4x4(matrix, i, j, lower);
+                }
+                for (; j < j_end; j++) {
+                    for (int r = i; r < i + 4; r++) {
+                        int temp = matrix[r][j];
+                        matrix[r][j] = matrix[j][r];
+                        matrix[j][r] = temp;
+                    }
+                }
+            }
+            for (; i < i_end; i++) {
+                // Leftover rows of a diagonal tile only swap their strictly upper part
+                for (int j = (bi == bj) ? i + 1 : bj; j < j_end; j++) {
+                    int temp = matrix[i][j];
+                    matrix[i][j] = matrix[j][i];
+                    matrix[j][i] = temp;
+                }
+            }
+        }
+    }
+}
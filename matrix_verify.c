@@ -0,0 +1,60 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include "matmul.h"
+
+// --- Reference Multiply and Freivalds Check ---
+
+// Trial t draws its vector from stream FREIVALDS_STREAM_BASE + t. Inputs are filled from
+// small stream numbers, usually with the same seed, so the check keeps to the top half
+// of the stream space to stay independent of the matrices it verifies.
+#define FREIVALDS_STREAM_BASE ((uint64_t)1 << 63)
+
+// Plain triple loop every engine is compared against. The sum is kept in unsigned
+// arithmetic so it wraps exactly like the int engines do on overflow.
+void matmul_reference(int rows, int inner, int cols, int** A, int** B, int** C) {
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            unsigned int sum = 0;
+            for (int k = 0; k < inner; k++) {
+                sum += (unsigned int)A[i][k] * (unsigned int)B[k][j];
+            }
+            C[i][j] = (int)sum;
+        }
+    }
+}
+
+// Freivalds' check that C == A * B in O(n^2) per trial: for a random 0/1 vector r,
+// A * (B * r) must equal C * r. A wrong C survives each trial with probability <= 1/2.
+// Arithmetic is mod 2^32 to agree with int overflow in the engines.
+int matmul_freivalds_check(int rows, int inner, int cols, int** A, int** B, int** C, int trials, uint64_t seed) {
+    int** r = matmul_allocate(1, cols);
+    unsigned int* Br = (unsigned int*)malloc(inner * sizeof(unsigned int));
+    MatmulFillOptions bits = matmul_fill_uniform(0, 1);
+    int passed = 1;
+    
+    for (int t = 0; t < trials && passed; t++) {
+        matmul_fill_random(1, cols, r, seed, FREIVALDS_STREAM_BASE + (uint64_t)t, &bits);
+        for (int k = 0; k < inner; k++) {
+            unsigned int sum = 0;
+            for (int j = 0; j < cols; j++) {
+                sum += (unsigned int)B[k][j] * (unsigned int)r[0][j];
+            }
+            Br[k] = sum;
+        }
+        for (int i = 0; i < rows && passed; i++) {
+            unsigned int expected = 0;
+            unsigned int actual = 0;
+            for (int k = 0; k < inner; k++) {
+                expected += (unsigned int)A[i][k] * Br[k];
+            }
+            for (int j = 0; j < cols; j++) {
+                actual += (unsigned int)C[i][j] * (unsigned int)r[0][j];
+            }
+            passed = (expected == actual);
+        }
+    }
+    
+    matmul_release(1, r);
+    free(Br);
+    return passed;
+}
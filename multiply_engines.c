@@ -0,0 +1,293 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include "matmul_internal.h"
+
+// --- Standard O(n^3) Algorithm ---
+
+void matmul_standard_ex(int n, int** MatrixA, int** MatrixB, int** MatrixC,
+                        MatmulLayout layout, MatmulTranspose transA, MatmulTranspose transB) {
+    int swap_a = operand_is_swapped(layout, transA);
+    int swap_b = operand_is_swapped(layout, transB);
+    int swap_c = (layout == MATMUL_COL_MAJOR);
+    
+    for(int i = 0; i < n; i++){
+        for(int j = 0; j < n; j++){
+            int sum = 0;
+            for(int k = 0; k < n; k++){
+                sum += *matrix_element(MatrixA, swap_a, i, k) * *matrix_element(MatrixB, swap_b, k, j);
+            }
+            *matrix_element(MatrixC, swap_c, i, j) = sum;
+        }
+    }
+}
+
+void matmul_standard(int n, int** MatrixA, int** MatrixB, int** MatrixC) {
+    matmul_standard_ex(n, MatrixA, MatrixB, MatrixC, MATMUL_ROW_MAJOR, MATMUL_NO_TRANS, MATMUL_NO_TRANS);
+}
+
+// C (rows x cols) = A (rows x inner) * B (inner x cols), all row-major.
+// Uses i-k-j order so the innermost loop walks rows of B and C contiguously.
+void matmul_rectangular(int rows, int inner, int cols, int** MatrixA, int** MatrixB, int** MatrixC) {
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            MatrixC[i][j] = 0;
+        }
+        for (int k = 0; k < inner; k++) {
+            int a_ik = MatrixA[i][k];
+            for (int j = 0; j < cols; j++) {
+                MatrixC[i][j] += a_ik * MatrixB[k][j];
+            }
+        }
+    }
+}
+
+// --- Simple Divide and Conquer O(n^3) Algorithm ---
+
+void matmul_divide_and_conquer_ex(int n, int** A, int** B, int** C,
+                                  MatmulLayout layout, MatmulTranspose transA, MatmulTranspose transB) {
+    int swap_a = operand_is_swapped(layout, transA);
+    int swap_b = operand_is_swapped(layout, transB);
+    int swap_c = (layout == MATMUL_COL_MAJOR);
+    
+    if (n == 1) {
+        C[0][0] = A[0][0] * B[0][0];
+        return;
+    }
+    
+    // Unrolled 2x2 base case saves the deepest and most numerous level of allocations
+    if (n == 2) {
+        int a00 = *matrix_element(A, swap_a, 0, 0), a01 = *matrix_element(A, swap_a, 0, 1);
+        int a10 = *matrix_element(A, swap_a, 1, 0), a11 = *matrix_element(A, swap_a, 1, 1);
+        int b00 = *matrix_element(B, swap_b, 0, 0), b01 = *matrix_element(B, swap_b, 0, 1);
+        int b10 = *matrix_element(B, swap_b, 1, 0), b11 = *matrix_element(B, swap_b, 1, 1);
+        *matrix_element(C, swap_c, 0, 0) = a00 * b00 + a01 * b10;
+        *matrix_element(C, swap_c, 0, 1) = a00 * b01 + a01 * b11;
+        *matrix_element(C, swap_c, 1, 0) = a10 * b00 + a11 * b10;
+        *matrix_element(C, swap_c, 1, 1) = a10 * b01 + a11 * b11;
+        return;
+    }
+    
+    int sub_n = n / 2;
+    
+    // Allocate 10 temporary matrices (sub-matrices of A, B, C, and one temporary for addition)
+    int** A11 = matmul_allocate_square(sub_n);
+    int** A12 = matmul_allocate_square(sub_n);
+    int** A21 = matmul_allocate_square(sub_n);
+    int** A22 = matmul_allocate_square(sub_n);
+    
+    int** B11 = matmul_allocate_square(sub_n);
+    int** B12 = matmul_allocate_square(sub_n);
+    int** B21 = matmul_allocate_square(sub_n);
+    int** B22 = matmul_allocate_square(sub_n);
+    
+    int** C11_temp = matmul_allocate_square(sub_n); // C11 = A11*B11 + A12*B21
+    int** C12_temp = matmul_allocate_square(sub_n);
+    int** C21_temp = matmul_allocate_square(sub_n);
+    int** C22_temp = matmul_allocate_square(sub_n);
+
+    int** TempStorage = matmul_allocate_square(sub_n); // Used for A12*B21, etc.
+    
+    // Partition A and B into row-major sub-matrices, reading through the layout/transpose flags
+    for (int i = 0; i < sub_n; i++) {
+        for (int j = 0; j < sub_n; j++) {
+            A11[i][j] = *matrix_element(A, swap_a, i, j);
+            A12[i][j] = *matrix_element(A, swap_a, i, j + sub_n);
+            A21[i][j] = *matrix_element(A, swap_a, i + sub_n, j);
+            A22[i][j] = *matrix_element(A, swap_a, i + sub_n, j + sub_n);
+            
+            B11[i][j] = *matrix_element(B, swap_b, i, j);
+            B12[i][j] = *matrix_element(B, swap_b, i, j + sub_n);
+            B21[i][j] = *matrix_element(B, swap_b, i + sub_n, j);
+            B22[i][j] = *matrix_element(B, swap_b, i + sub_n, j + sub_n);
+        }
+    }
+    
+    // C11 = A11*B11 + A12*B21
+    matmul_divide_and_conquer(sub_n, A11, B11, C11_temp); // A11*B11 stored in C11_temp
+    matmul_divide_and_conquer(sub_n, A12, B21, TempStorage); // A12*B21 stored in TempStorage
+    matmul_add(sub_n, C11_temp, TempStorage, C11_temp); // C11_temp = C11_temp + TempStorage
+    
+    // C12 = A11*B12 + A12*B22
+    matmul_divide_and_conquer(sub_n, A11, B12, C12_temp);
+    matmul_divide_and_conquer(sub_n, A12, B22, TempStorage);
+    matmul_add(sub_n, C12_temp, TempStorage, C12_temp);
+    
+    // C21 = A21*B11 + A22*B21
+    matmul_divide_and_conquer(sub_n, A21, B11, C21_temp);
+    matmul_divide_and_conquer(sub_n, A22, B21, TempStorage);
+    matmul_add(sub_n, C21_temp, TempStorage, C21_temp);
+    
+    // C22 = A21*B12 + A22*B22
+    matmul_divide_and_conquer(sub_n, A21, B12, C22_temp);
+    matmul_divide_and_conquer(sub_n, A22, B22, TempStorage);
+    matmul_add(sub_n, C22_temp, TempStorage, C22_temp);
+    
+    // Combine result sub-matrices into C
+    for (int i = 0; i < sub_n; i++) {
+        for (int j = 0; j < sub_n; j++) {
+            *matrix_element(C, swap_c, i, j) = C11_temp[i][j];
+            *matrix_element(C, swap_c, i, j + sub_n) = C12_temp[i][j];
+            *matrix_element(C, swap_c, i + sub_n, j) = C21_temp[i][j];
+            *matrix_element(C, swap_c, i + sub_n, j + sub_n) = C22_temp[i][j];
+        }
+    }
+    
+    // Release all temporary memory
+    matmul_release(sub_n, A11); matmul_release(sub_n, A12);
+    matmul_release(sub_n, A21); matmul_release(sub_n, A22);
+    matmul_release(sub_n, B11); matmul_release(sub_n, B12);
+    matmul_release(sub_n, B21); matmul_release(sub_n, B22);
+    matmul_release(sub_n, C11_temp); matmul_release(sub_n, C12_temp);
+    matmul_release(sub_n, C21_temp); matmul_release(sub_n, C22_temp);
+    matmul_release(sub_n, TempStorage);
+}
+
+void matmul_divide_and_conquer(int n, int** A, int** B, int** C) {
+    matmul_divide_and_conquer_ex(n, A, B, C, MATMUL_ROW_MAJOR, MATMUL_NO_TRANS, MATMUL_NO_TRANS);
+}
+
+// --- Strassen's O(n^2.807) Algorithm ---
+
+void matmul_strassen_ex(int n, int **A, int **B, int **C,
+                        MatmulLayout layout, MatmulTranspose transA, MatmulTranspose transB) {
+    int swap_a = operand_is_swapped(layout, transA);
+    int swap_b = operand_is_swapped(layout, transB);
+    int swap_c = (layout == MATMUL_COL_MAJOR);
+    
+    if (n == 1) {
+        C[0][0] = A[0][0] * B[0][0];
+        return;
+    }
+    
+    int sub_n = n / 2;
+    
+    // Allocate 19 matrices: 4 for A, 4 for B, 4 for C, 7 for P, and 2 temps
+    int **A11 = matmul_allocate_square(sub_n); int **A12 = matmul_allocate_square(sub_n);
+    int **A21 = matmul_allocate_square(sub_n); int **A22 = matmul_allocate_square(sub_n);
+    int **B11 = matmul_allocate_square(sub_n); int **B12 = matmul_allocate_square(sub_n);
+    int **B21 = matmul_allocate_square(sub_n); int **B22 = matmul_allocate_square(sub_n);
+    int **C11 = matmul_allocate_square(sub_n); int **C12 = matmul_allocate_square(sub_n);
+    int **C21 = matmul_allocate_square(sub_n); int **C22 = matmul_allocate_square(sub_n);
+    int **P1 = matmul_allocate_square(sub_n); int **P2 = matmul_allocate_square(sub_n);
+    int **P3 = matmul_allocate_square(sub_n); int **P4 = matmul_allocate_square(sub_n);
+    int **P5 = matmul_allocate_square(sub_n); int **P6 = matmul_allocate_square(sub_n);
+    int **P7 = matmul_allocate_square(sub_n);
+    int **TempAddition = matmul_allocate_square(sub_n); 
+    int **TempSubtraction = matmul_allocate_square(sub_n);
+    
+    // Partition A and B into row-major sub-matrices, reading through the layout/transpose flags
+    for (int i = 0; i < sub_n; i++) {
+        for (int j = 0; j < sub_n; j++) {
+            A11[i][j] = *matrix_element(A, swap_a, i, j); A12[i][j] = *matrix_element(A, swap_a, i, j + sub_n);
+            A21[i][j] = *matrix_element(A, swap_a, i + sub_n, j); A22[i][j] = *matrix_element(A, swap_a, i + sub_n, j + sub_n);
+            B11[i][j] = *matrix_element(B, swap_b, i, j); B12[i][j] = *matrix_element(B, swap_b, i, j + sub_n);
+            B21[i][j] = *matrix_element(B, swap_b, i + sub_n, j); B22[i][j] = *matrix_element(B, swap_b, i + sub_n, j + sub_n);
+        }
+    }
+    
+    // Calculate the 7 products (P1 to P7)
+    // P1 = A11 * (B12 - B22)
+    matmul_subtract(sub_n, B12, B22, TempSubtraction);
+    matmul_strassen(sub_n, A11, TempSubtraction, P1);
+    
+    // P2 = (A11 + A12) * B22
+    matmul_add(sub_n, A11, A12, TempAddition);
+    matmul_strassen(sub_n, TempAddition, B22, P2);
+    
+    // P3 = (A21 + A22) * B11
+    matmul_add(sub_n, A21, A22, TempAddition);
+    matmul_strassen(sub_n, TempAddition, B11, P3);
+    
+    // P4 = A22 * (B21 - B11)
+    matmul_subtract(sub_n, B21, B11, TempSubtraction);
+    matmul_strassen(sub_n, A22, TempSubtraction, P4);
+    
+    // P5 = (A11 + A22) * (B11 + B22)
+    matmul_add(sub_n, A11, A22, TempAddition);
+    matmul_add(sub_n, B11, B22, TempSubtraction);
+    matmul_strassen(sub_n, TempAddition, TempSubtraction, P5);
+    
+    // P6 = (A12 - A22) * (B21 + B22)
+    matmul_subtract(sub_n, A12, A22, TempSubtraction);
+    matmul_add(sub_n, B21, B22, TempAddition);
+    matmul_strassen(sub_n, TempSubtraction, TempAddition, P6);
+    
+    // P7 = (A11 - A21) * (B11 + B12)
+    matmul_subtract(sub_n, A11, A21, TempSubtraction);
+    matmul_add(sub_n, B11, B12, TempAddition);
+    matmul_strassen(sub_n, TempSubtraction, TempAddition, P7);
+    
+    // Combine P's to get result sub-matrices C11, C12, C21, C22
+    // C11 = P5 + P4 - P2 + P6
+    matmul_add(sub_n, P5, P4, TempAddition); // TempAddition = P5 + P4
+    matmul_subtract(sub_n, TempAddition, P2, TempSubtraction); // TempSubtraction = P5 + P4 - P2
+    matmul_add(sub_n, TempSubtraction, P6, C11); // C11 = TempSubtraction + P6
+    
+    // C12 = P1 + P2
+    matmul_add(sub_n, P1, P2, C12);
+    
+    // C21 = P3 + P4
+    matmul_add(sub_n, P3, P4, C21);
+    
+    // C22 = P5 + P1 - P3 - P7
+    matmul_add(sub_n, P5, P1, TempAddition); // TempAddition = P5 + P1
+    matmul_subtract(sub_n, TempAddition, P3, TempSubtraction); // TempSubtraction = P5 + P1 - P3
+    matmul_subtract(sub_n, TempSubtraction, P7, C22); // C22 = TempSubtraction - P7
+    
+    // Recombine C sub-matrices into final result C
+    for (int i = 0; i < sub_n; i++) {
+        for (int j = 0; j < sub_n; j++) {
+            *matrix_element(C, swap_c, i, j) = C11[i][j];
+            *matrix_element(C, swap_c, i, j + sub_n) = C12[i][j];
+            *matrix_element(C, swap_c, i + sub_n, j) = C21[i][j];
+            *matrix_element(C, swap_c, i + sub_n, j + sub_n) = C22[i][j];
+        }
+    }
+    
+    // Release all 19 temporary memory allocations
+    matmul_release(sub_n, A11); matmul_release(sub_n, A12); matmul_release(sub_n, A21); matmul_release(sub_n, A22);
+    matmul_release(sub_n, B11); matmul_release(sub_n, B12); matmul_release(sub_n, B21); matmul_release(sub_n, B22);
+    matmul_release(sub_n, C11); matmul_release(sub_n, C12); matmul_release(sub_n, C21); matmul_release(sub_n, C22);
+    matmul_release(sub_n, P1); matmul_release(sub_n, P2); matmul_release(sub_n, P3); matmul_release(sub_n, P4);
+    matmul_release(sub_n, P5); matmul_release(sub_n, P6); matmul_release(sub_n, P7);
+    matmul_release(sub_n, TempAddition); matmul_release(sub_n, TempSubtraction);
+}
+
+void matmul_strassen(int n, int **A, int **B, int **C) {
+    matmul_strassen_ex(n, A, B, C, MATMUL_ROW_MAJOR, MATMUL_NO_TRANS, MATMUL_NO_TRANS);
+}
+
+// --- Modular Element Mode ---
+
+// C = A * B with every element reduced into [0, modulus). Inputs must already be reduced.
+// Products are accumulated in 64 bits and only reduced once the row accumulator could
+// overflow, instead of taking a remainder after every multiply-add.
+void matmul_modular(int n, int** A, int** B, int** C, int modulus) {
+    uint64_t max_term = (uint64_t)(modulus - 1) * (uint64_t)(modulus - 1);
+    int terms_per_reduction = (max_term == 0 || UINT64_MAX / max_term > (uint64_t)n) ? n : (int)(UINT64_MAX / max_term);
+    uint64_t* row = (uint64_t*)malloc(n * sizeof(uint64_t));
+    
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            row[j] = 0;
+        }
+        int pending = 0;
+        for (int k = 0; k < n; k++) {
+            uint64_t a_ik = (uint64_t)A[i][k];
+            for (int j = 0; j < n; j++) {
+                row[j] += a_ik * (uint64_t)B[k][j];
+            }
+            if (++pending == terms_per_reduction) {
+                // Leaves room for terms_per_reduction - 1 more terms on top of the remainder
+                for (int j = 0; j < n; j++) {
+                    row[j] %= (uint64_t)modulus;
+                }
+                pending = 1;
+            }
+        }
+        for (int j = 0; j < n; j++) {
+            C[i][j] = (int)(row[j] % (uint64_t)modulus);
+        }
+    }
+    free(row);
+}
@@ -0,0 +1,570 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include "matmul_internal.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define TEST_DEFAULT_SEED 24293916065ULL
+
+// --- Differential Correctness Checks ---
+
+#define FREIVALDS_TRIALS 20
+
+static int verify_checks = 0;
+static int verify_failures = 0;
+
+static void verify_report(const char* name, int rows, int inner, int cols, int passed) {
+    verify_checks++;
+    if (!passed) {
+        verify_failures++;
+        printf("FAIL %s (%dx%d * %dx%d)\n", name, rows, inner, inner, cols);
+    }
+}
+
+// Compares Expected against Actual read through its "swapped" storage bit.
+static int matrices_match(int rows, int cols, int** Expected, int** Actual, int actual_swapped) {
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            if (Expected[i][j] != *matrix_element(Actual, actual_swapped, i, j)) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+// Runs every square engine on the same inputs, under every layout/transpose combination
+// when all_flags is set and only plain row-major otherwise. The recursive engines need a
+// power of two, so other sizes only run the classical one.
+static void verify_square_engines(int n, int** A, int** B, int** Reference, int all_flags) {
+    int** StoredA = matmul_allocate_square(n);
+    int** StoredB = matmul_allocate_square(n);
+    int** C = matmul_allocate_square(n);
+    const char* engine_names[3] = {"standard", "divide_and_conquer", "strassen"};
+    
+    int engines = is_power_of_two(n) ? 3 : 1;
+    int last = all_flags ? 1 : 0;
+    for (int layout = MATMUL_ROW_MAJOR; layout <= last; layout++) {
+        for (int transA = MATMUL_NO_TRANS; transA <= last; transA++) {
+            for (int transB = MATMUL_NO_TRANS; transB <= last; transB++) {
+                // Store each operand so that reading it with these flags yields A and B
+                if (operand_is_swapped(layout, transA)) {
+                    matmul_transpose(n, n, A, StoredA);
+                } else {
+                    matmul_copy_square(n, A, StoredA);
+                }
+                if (operand_is_swapped(layout, transB)) {
+                    matmul_transpose(n, n, B, StoredB);
+                } else {
+                    matmul_copy_square(n, B, StoredB);
+                }
+                
+                for (int engine = 0; engine < engines; engine++) {
+                    if (engine == 0) {
+                        matmul_standard_ex(n, StoredA, StoredB, C, layout, transA, transB);
+                    } else if (engine == 1) {
+                        matmul_divide_and_conquer_ex(n, StoredA, StoredB, C, layout, transA, transB);
+                    } else {
+                        matmul_strassen_ex(n, StoredA, StoredB, C, layout, transA, transB);
+                    }
+                    char name[96];
+                    snprintf(name, sizeof(name), "%s layout=%d transA=%d transB=%d", engine_names[engine], layout, transA, transB);
+                    verify_report(name, n, n, n, matrices_match(n, n, Reference, C, layout == MATMUL_COL_MAJOR));
+                }
+            }
+        }
+    }
+    
+    matmul_transpose(n, n, A, StoredA);
+    matmul_transpose_in_place(n, StoredA);
+    verify_report("transpose round trip", n, n, n, matrices_match(n, n, A, StoredA, 0));
+    
+    matmul_release(n, StoredA);
+    matmul_release(n, StoredB);
+    matmul_release(n, C);
+}
+
+// Covers the 4x4 register blocks, the ragged tile edges and the tile boundaries of both
+// transposes on a rows x cols operand and on a rows x rows square.
+static void verify_transposes(int rows, int cols, uint64_t seed) {
+    int** Source = matmul_allocate(rows, cols);
+    int** Transposed = matmul_allocate(cols, rows);
+    int** Square = matmul_allocate_square(rows);
+    int** InPlace = matmul_allocate_square(rows);
+    MatmulFillOptions fill = matmul_fill_uniform(-99, 99);
+    matmul_fill_random(rows, cols, Source, seed, 300, &fill);
+    matmul_fill_random(rows, rows, Square, seed, 301, &fill);
+    
+    matmul_transpose(rows, cols, Source, Transposed);
+    verify_report("matmul_transpose", rows, cols, rows, matrices_match(rows, cols, Source, Transposed, 1));
+    matmul_copy_square(rows, Square, InPlace);
+    matmul_transpose_in_place(rows, InPlace);
+    verify_report("matmul_transpose_in_place", rows, rows, rows, matrices_match(rows, rows, Square, InPlace, 1));
+    
+    matmul_release(rows, Source);
+    matmul_release(cols, Transposed);
+    matmul_release(rows, Square);
+    matmul_release(rows, InPlace);
+}
+
+// A hand-built model where Strassen is almost free, so every square power-of-two step
+// is planned on it; calibrated models rarely pick it at the sizes tested here.
+static MatmulCostModel strassen_forcing_model(void) {
+    MatmulCostModel model = {1e-9, 1e-15};
+    return model;
+}
+
+static void verify_modular_and_power(int n, int** A, uint64_t seed) {
+    const int modulus = 1000000007;
+    int** Reduced = matmul_allocate_square(n);
+    int** Expected = matmul_allocate_square(n);
+    int** Next = matmul_allocate_square(n);
+    int** Actual = matmul_allocate_square(n);
+    MatmulFillOptions residues = matmul_fill_uniform(0, modulus - 1);
+    matmul_fill_random(n, n, Reduced, seed, 1000, &residues);
+    
+    // Expected = Reduced^k mod modulus, built one reference multiply at a time
+    for (int row = 0; row < n; row++) {
+        for (int col = 0; col < n; col++) {
+            Expected[row][col] = (row == col);
+        }
+    }
+    for (int k = 0; k <= 9; k++) {
+        matmul_power(n, Reduced, Actual, k, modulus, NULL, NULL);
+        verify_report("matmul_power modular", n, n, n, matrices_match(n, n, Expected, Actual, 0));
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                uint64_t sum = 0;
+                for (int q = 0; q < n; q++) {
+                    sum = (sum + (uint64_t)Expected[i][q] * (uint64_t)Reduced[q][j]) % (uint64_t)modulus;
+                }
+                Next[i][j] = (int)sum;
+            }
+        }
+        matmul_copy_square(n, Next, Expected);
+    }
+    
+    // Plain mode wraps like int, so small powers of small entries compare exactly. It runs
+    // once on the classical kernel and once with Strassen forced for the ping-pong steps,
+    // both drawing scratch buffers from one pool instead of a private one per call.
+    MatmulBufferPool* pool = matmul_pool_create();
+    MatmulCostModel strassen_model = strassen_forcing_model();
+    const MatmulCostModel* models[2] = {NULL, &strassen_model};
+    const char* names[2] = {"matmul_power plain", "matmul_power plain strassen"};
+    for (int m = 0; m < 2; m++) {
+        for (int row = 0; row < n; row++) {
+            for (int col = 0; col < n; col++) {
+                Expected[row][col] = (row == col);
+            }
+        }
+        for (int k = 0; k <= 5; k++) {
+            matmul_power(n, A, Actual, k, 0, models[m], pool);
+            verify_report(names[m], n, n, n, matrices_match(n, n, Expected, Actual, 0));
+            matmul_reference(n, n, n, Expected, A, Next);
+            matmul_copy_square(n, Next, Expected);
+        }
+    }
+    
+    matmul_pool_destroy(pool);
+    matmul_release(n, Reduced);
+    matmul_release(n, Expected);
+    matmul_release(n, Next);
+    matmul_release(n, Actual);
+}
+
+static void verify_rectangular_and_chain(int rows, int inner, int cols, const MatmulCostModel* model, uint64_t seed) {
+    int dims[4] = {rows, inner, cols, inner};
+    int** A = matmul_allocate(rows, inner);
+    int** B = matmul_allocate(inner, cols);
+    int** D = matmul_allocate(cols, inner);
+    int** AB = matmul_allocate(rows, cols);
+    int** Product = matmul_allocate(rows, cols);
+    int** Expected = matmul_allocate(rows, inner);
+    int** Actual = matmul_allocate(rows, inner);
+    MatmulFillOptions fill = matmul_fill_uniform(-99, 99);
+    matmul_fill_random(rows, inner, A, seed, 1, &fill);
+    matmul_fill_random(inner, cols, B, seed, 2, &fill);
+    matmul_fill_random(cols, inner, D, seed, 3, &fill);
+    
+    matmul_reference(rows, inner, cols, A, B, AB);
+    matmul_rectangular(rows, inner, cols, A, B, Product);
+    verify_report("matmul_rectangular", rows, inner, cols, matrices_match(rows, cols, AB, Product, 0));
+    verify_report("freivalds accepts", rows, inner, cols, matmul_freivalds_check(rows, inner, cols, A, B, Product, FREIVALDS_TRIALS, seed));
+    
+    int*** chain = (int***)malloc(3 * sizeof(int**));
+    chain[0] = A; chain[1] = B; chain[2] = D;
+    matmul_reference(rows, cols, inner, AB, D, Expected);
+    matmul_chain(3, dims, chain, Actual, model, NULL, NULL);
+    verify_report("matmul_chain", rows, cols, inner, matrices_match(rows, inner, Expected, Actual, 0));
+    free(chain);
+    
+    matmul_release(rows, A);
+    matmul_release(inner, B);
+    matmul_release(cols, D);
+    matmul_release(rows, AB);
+    matmul_release(rows, Product);
+    matmul_release(rows, Expected);
+    matmul_release(rows, Actual);
+}
+
+// Runs chains whose best order is known under the Strassen-forcing model and under no
+// model at all, checking both the reported parenthesisation and the product. Each chain
+// also runs on one pool shared across chains, so chain 1 grows chain 0's buffers.
+static void verify_chain_planner(uint64_t seed) {
+    // Chain 0 plans (A4 A5) on Strassen into a pooled buffer that an earlier, larger 32x8
+    // intermediate left behind; chain 1 only prefers (A1 A2) first because it is on Strassen
+    int chain_dims[2][6] = {{8, 32, 32, 8, 8, 8}, {64, 64, 64, 8, 0, 0}};
+    int counts[2] = {5, 3};
+    const char* strassen_orders[2] = {"((A1 (A2 A3)) (A4 A5))", "((A1 A2) A3)"};
+    const char* classical_orders[2] = {"((A1 (A2 A3)) (A4 A5))", "(A1 (A2 A3))"};
+    MatmulCostModel model = strassen_forcing_model();
+    MatmulFillOptions fill = matmul_fill_uniform(-9, 9);
+    MatmulBufferPool* pool = matmul_pool_create();
+    
+    for (int c = 0; c < 2; c++) {
+        int count = counts[c];
+        const int* dims = chain_dims[c];
+        int*** chain = (int***)malloc(count * sizeof(int**));
+        for (int m = 0; m < count; m++) {
+            chain[m] = matmul_allocate(dims[m], dims[m + 1]);
+            matmul_fill_random(dims[m], dims[m + 1], chain[m], seed, 200 + m, &fill);
+        }
+        
+        // Expected = A1 * ... * Ak, left to right with the reference multiply
+        int** Expected = matmul_allocate(dims[0], dims[1]);
+        for (int row = 0; row < dims[0]; row++) {
+            for (int col = 0; col < dims[1]; col++) {
+                Expected[row][col] = chain[0][row][col];
+            }
+        }
+        for (int m = 1; m < count; m++) {
+            int** Next = matmul_allocate(dims[0], dims[m + 1]);
+            matmul_reference(dims[0], dims[m], dims[m + 1], Expected, chain[m], Next);
+            matmul_release(dims[0], Expected);
+            Expected = Next;
+        }
+        
+        int** Actual = matmul_allocate(dims[0], dims[count]);
+        MatmulChainReport report;
+        matmul_chain(count, dims, chain, Actual, &model, NULL, &report);
+        verify_report("matmul_chain strassen", dims[0], dims[1], dims[count], matrices_match(dims[0], dims[count], Expected, Actual, 0));
+        verify_report("matmul_chain strassen order", dims[0], dims[1], dims[count], strcmp(report.order, strassen_orders[c]) == 0);
+        
+        matmul_chain(count, dims, chain, Actual, NULL, NULL, &report);
+        verify_report("matmul_chain no model", dims[0], dims[1], dims[count], matrices_match(dims[0], dims[count], Expected, Actual, 0));
+        verify_report("matmul_chain no model order", dims[0], dims[1], dims[count], strcmp(report.order, classical_orders[c]) == 0);
+        
+        for (int repeat = 0; repeat < 2; repeat++) {
+            matmul_chain(count, dims, chain, Actual, &model, pool, NULL);
+            verify_report("matmul_chain shared pool", dims[0], dims[1], dims[count], matrices_match(dims[0], dims[count], Expected, Actual, 0));
+        }
+        
+        for (int m = 0; m < count; m++) {
+            matmul_release(dims[m], chain[m]);
+        }
+        free(chain);
+        matmul_release(dims[0], Expected);
+        matmul_release(dims[0], Actual);
+    }
+    matmul_pool_destroy(pool);
+}
+
+// Products too large to check against the reference are verified with Freivalds only,
+// plus one deliberately corrupted entry to make sure the check actually rejects.
+static void verify_large_product(int n, uint64_t seed) {
+    int** A = matmul_allocate_square(n);
+    int** B = matmul_allocate_square(n);
+    int** C = matmul_allocate_square(n);
+    MatmulFillOptions fill = matmul_fill_uniform(-99, 99);
+    matmul_fill_random(n, n, A, seed, 1, &fill);
+    matmul_fill_random(n, n, B, seed, 2, &fill);
+    
+    matmul_rectangular(n, n, n, A, B, C);
+    verify_report("freivalds accepts large", n, n, n, matmul_freivalds_check(n, n, n, A, B, C, FREIVALDS_TRIALS, seed));
+    C[n / 3][n / 5] += 1;
+    verify_report("freivalds rejects corrupted", n, n, n, !matmul_freivalds_check(n, n, n, A, B, C, FREIVALDS_TRIALS, seed));
+    
+    matmul_release(n, A);
+    matmul_release(n, B);
+    matmul_release(n, C);
+}
+
+// Patches a cached product after row, column and rank-k changes and compares it with a
+// fresh reference product, once below and once above the recompute threshold.
+static void verify_incremental_updates(int rows, int inner, int cols, uint64_t seed) {
+    int** A = matmul_allocate(rows, inner);
+    int** B = matmul_allocate(inner, cols);
+    int** C = matmul_allocate(rows, cols);
+    int** Expected = matmul_allocate(rows, cols);
+    MatmulFillOptions fill = matmul_fill_uniform(-99, 99);
+    matmul_fill_random(rows, inner, A, seed, 1, &fill);
+    matmul_fill_random(inner, cols, B, seed, 2, &fill);
+    matmul_reference(rows, inner, cols, A, B, C);
+    
+    int changed[3] = {0, rows / 2, rows - 1};
+    for (int c = 0; c < 3; c++) {
+        for (int q = 0; q < inner; q++) {
+            A[changed[c]][q] += q - c;
+        }
+    }
+    int recomputed = matmul_update_rows(rows, inner, cols, A, B, C, changed, 3, MATMUL_UPDATE_RECOMPUTE_FRACTION);
+    matmul_reference(rows, inner, cols, A, B, Expected);
+    verify_report("matmul_update_rows", rows, inner, cols, matrices_match(rows, cols, Expected, C, 0));
+    verify_report("matmul_update_rows patches", rows, inner, cols, recomputed == (3.0 / rows > MATMUL_UPDATE_RECOMPUTE_FRACTION));
+    
+    changed[0] = cols - 1; changed[1] = cols / 3; changed[2] = 0;
+    for (int c = 0; c < 3; c++) {
+        for (int q = 0; q < inner; q++) {
+            B[q][changed[c]] -= q + c;
+        }
+    }
+    recomputed = matmul_update_cols(rows, inner, cols, A, B, C, changed, 3, MATMUL_UPDATE_RECOMPUTE_FRACTION);
+    matmul_reference(rows, inner, cols, A, B, Expected);
+    verify_report("matmul_update_cols", rows, inner, cols, matrices_match(rows, cols, Expected, C, 0));
+    verify_report("matmul_update_cols patches", rows, inner, cols, recomputed == (3.0 / cols > MATMUL_UPDATE_RECOMPUTE_FRACTION));
+    
+    // A column listed twice must be recomputed, not accumulated twice
+    int duplicated[2] = {cols / 2, cols / 2};
+    for (int q = 0; q < inner; q++) {
+        B[q][duplicated[0]] += 2 * q + 1;
+    }
+    matmul_update_cols(rows, inner, cols, A, B, C, duplicated, 2, 1.0);
+    matmul_reference(rows, inner, cols, A, B, Expected);
+    verify_report("matmul_update_cols duplicates", rows, inner, cols, matrices_match(rows, cols, Expected, C, 0));
+    
+    int ranks[2] = {1, inner};
+    for (int r = 0; r < 2; r++) {
+        int k = ranks[r];
+        int** U = matmul_allocate(rows, k);
+        int** V = matmul_allocate(inner, k);
+        MatmulFillOptions small = matmul_fill_uniform(-3, 3);
+        matmul_fill_random(rows, k, U, seed, 3 + 2 * r, &small);
+        matmul_fill_random(inner, k, V, seed, 4 + 2 * r, &small);
+        recomputed = matmul_update_rank_k_a(rows, inner, cols, A, B, C, k, U, V, MATMUL_UPDATE_RECOMPUTE_FRACTION);
+        matmul_reference(rows, inner, cols, A, B, Expected);
+        verify_report("matmul_update_rank_k_a", rows, inner, cols, matrices_match(rows, cols, Expected, C, 0));
+        double fraction = (double)k / rows + (double)k / inner;
+        verify_report("matmul_update_rank_k_a threshold", rows, inner, cols, recomputed == (fraction > MATMUL_UPDATE_RECOMPUTE_FRACTION));
+        matmul_release(rows, U);
+        matmul_release(inner, V);
+        
+        U = matmul_allocate(inner, k);
+        V = matmul_allocate(cols, k);
+        matmul_fill_random(inner, k, U, seed, 7 + 2 * r, &small);
+        matmul_fill_random(cols, k, V, seed, 8 + 2 * r, &small);
+        recomputed = matmul_update_rank_k_b(rows, inner, cols, A, B, C, k, U, V, MATMUL_UPDATE_RECOMPUTE_FRACTION);
+        matmul_reference(rows, inner, cols, A, B, Expected);
+        verify_report("matmul_update_rank_k_b", rows, inner, cols, matrices_match(rows, cols, Expected, C, 0));
+        fraction = (double)k / cols + (double)k / inner;
+        verify_report("matmul_update_rank_k_b threshold", rows, inner, cols, recomputed == (fraction > MATMUL_UPDATE_RECOMPUTE_FRACTION));
+        matmul_release(inner, U);
+        matmul_release(cols, V);
+    }
+    
+    matmul_release(rows, A);
+    matmul_release(inner, B);
+    matmul_release(rows, C);
+    matmul_release(rows, Expected);
+}
+
+// --- Random Fill Checks ---
+
+#define FILL_THREADS 7
+
+// FNV-1a over the entries, so two fills can be compared without keeping both around.
+static uint64_t matrix_hash(int rows, int cols, int** matrix) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (int row = 0; row < rows; row++) {
+        for (int col = 0; col < cols; col++) {
+            hash = (hash ^ (uint32_t)matrix[row][col]) * 0x100000001B3ULL;
+        }
+    }
+    return hash;
+}
+
+static void verify_random_fills(uint64_t seed) {
+    // Known-answer vectors from the Philox4x32-10 reference implementation (Random123)
+    uint32_t kat_input[3][6] = {
+        {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},
+        {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+        {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344, 0xa4093822, 0x299f31d0},
+    };
+    uint32_t kat_output[3][4] = {
+        {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8},
+        {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd},
+        {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1},
+    };
+    for (int v = 0; v < 3; v++) {
+        uint32_t counter[4] = {kat_input[v][0], kat_input[v][1], kat_input[v][2], kat_input[v][3]};
+        philox4x32_10(counter, kat_input[v][4], kat_input[v][5]);
+        verify_report("philox known answer", 1, 4, 1, memcmp(counter, kat_output[v], sizeof(counter)) == 0);
+    }
+    
+    // Element 0 of stream 0 is the all-zero counter, so a full-range fill must start with
+    // the first known answer offset by INT_MIN
+    int n = 256;
+    int** M = matmul_allocate_square(n);
+    int** Again = matmul_allocate_square(n);
+    MatmulFillOptions full = matmul_fill_uniform(INT_MIN, INT_MAX);
+    matmul_fill_random(n, n, M, 0, 0, &full);
+    verify_report("fill uses philox", n, n, n, (uint32_t)M[0][0] == (uint32_t)INT_MIN + kat_output[0][0]);
+    
+    MatmulFillOptions fills[4] = {
+        matmul_fill_uniform(-99, 99),
+        matmul_fill_sparse(1, 99, 0.1),
+        matmul_fill_banded(1, 99, 3),
+        full,
+    };
+    const char* fill_names[4] = {"uniform", "sparse", "banded", "full range"};
+    for (int f = 0; f < 4; f++) {
+        char name[64];
+        matmul_fill_random(n, n, M, seed, 7, &fills[f]);
+        matmul_fill_random(n, n, Again, seed, 7, &fills[f]);
+        snprintf(name, sizeof(name), "fill %s reproducible", fill_names[f]);
+        verify_report(name, n, n, n, matrices_match(n, n, M, Again, 0));
+        matmul_fill_random(n, n, Again, seed, 8, &fills[f]);
+        snprintf(name, sizeof(name), "fill %s streams differ", fill_names[f]);
+        verify_report(name, n, n, n, !matrices_match(n, n, M, Again, 0));
+        
+#ifdef _OPENMP
+        // n * n is above the parallel threshold, so this really compares 1 and N threads
+        int saved_threads = omp_get_max_threads();
+        omp_set_num_threads(1);
+        matmul_fill_random(n, n, M, seed, 9, &fills[f]);
+        uint64_t serial_hash = matrix_hash(n, n, M);
+        omp_set_num_threads(FILL_THREADS);
+        matmul_fill_random(n, n, M, seed, 9, &fills[f]);
+        omp_set_num_threads(saved_threads);
+        snprintf(name, sizeof(name), "fill %s thread count", fill_names[f]);
+        verify_report(name, n, n, n, matrix_hash(n, n, M) == serial_hash);
+#endif
+    }
+    
+    // Values stay in [low, high] and reach both ends
+    matmul_fill_random(n, n, M, seed, 10, &fills[0]);
+    int low = INT_MAX;
+    int high = INT_MIN;
+    for (int row = 0; row < n; row++) {
+        for (int col = 0; col < n; col++) {
+            low = M[row][col] < low ? M[row][col] : low;
+            high = M[row][col] > high ? M[row][col] : high;
+        }
+    }
+    verify_report("fill uniform bounds", n, n, n, low == -99 && high == 99);
+    
+    // Sparse entries drawn from [1, 99] are zero exactly when dropped; 0.1 of 65536 entries
+    // has a standard deviation near 0.0012, so 0.01 either way never fails by chance
+    matmul_fill_random(n, n, M, seed, 11, &fills[1]);
+    int nonzero = 0;
+    int in_range = 1;
+    for (int row = 0; row < n; row++) {
+        for (int col = 0; col < n; col++) {
+            nonzero += M[row][col] != 0;
+            in_range &= M[row][col] == 0 || (M[row][col] >= 1 && M[row][col] <= 99);
+        }
+    }
+    double density = (double)nonzero / ((double)n * n);
+    verify_report("fill sparse density", n, n, n, in_range && density > 0.09 && density < 0.11);
+    
+    matmul_fill_random(n, n, M, seed, 12, &fills[2]);
+    int banded = 1;
+    for (int row = 0; row < n; row++) {
+        for (int col = 0; col < n; col++) {
+            int inside = abs(row - col) <= 3;
+            banded &= inside ? (M[row][col] >= 1 && M[row][col] <= 99) : M[row][col] == 0;
+        }
+    }
+    verify_report("fill banded", n, n, n, banded);
+    
+    MatmulFillOptions identity = matmul_fill_identity();
+    matmul_fill_random(n, n, M, seed, 13, &identity);
+    int is_identity = 1;
+    for (int row = 0; row < n; row++) {
+        for (int col = 0; col < n; col++) {
+            is_identity &= M[row][col] == (row == col);
+        }
+    }
+    verify_report("fill identity", n, n, n, is_identity);
+    
+    // An empty range is rejected and leaves the matrix as it was
+    matmul_copy_square(n, M, Again);
+    MatmulFillOptions empty = matmul_fill_uniform(5, 4);
+    int status = matmul_fill_random(n, n, M, seed, 14, &empty);
+    verify_report("fill rejects high < low", n, n, n, status == -1 && matrices_match(n, n, Again, M, 0));
+    
+    matmul_release(n, M);
+    matmul_release(n, Again);
+}
+
+// Returns the number of failed checks.
+static int run_verification_suite(uint64_t seed) {
+    verify_checks = 0;
+    verify_failures = 0;
+    
+    MatmulFillOptions fills[4] = {
+        matmul_fill_uniform(-99, 99),
+        matmul_fill_sparse(-99, 99, 0.1),
+        matmul_fill_banded(-99, 99, 2),
+        matmul_fill_identity(),
+    };
+    // The recursive engines allocate at every level, so square sizes stop at 64. The odd
+    // sizes cover the classical, modular and power paths that take any n.
+    int square_sizes[] = {1, 2, 3, 4, 8, 16, 17, 32, 33, 64};
+    for (size_t s = 0; s < sizeof(square_sizes) / sizeof(square_sizes[0]); s++) {
+        int n = square_sizes[s];
+        int** A = matmul_allocate_square(n);
+        int** B = matmul_allocate_square(n);
+        int** Reference = matmul_allocate_square(n);
+        for (int f = 0; f < 4; f++) {
+            matmul_fill_random(n, n, A, seed, 2 * f, &fills[f]);
+            matmul_fill_random(n, n, B, seed, 2 * f + 1, &fills[0]);
+            matmul_reference(n, n, n, A, B, Reference);
+            // Layout/transpose handling does not depend on the values, so the other fills run plain
+            verify_square_engines(n, A, B, Reference, f == 0);
+        }
+        MatmulFillOptions small = matmul_fill_uniform(-3, 3);
+        matmul_fill_random(n, n, A, seed, 100, &small);
+        verify_modular_and_power(n, A, seed);
+        matmul_release(n, A);
+        matmul_release(n, B);
+        matmul_release(n, Reference);
+    }
+    
+    MatmulCostModel model;
+    matmul_calibrate_cost_model(&model);
+    int shapes[][3] = {
+        {1, 1, 1}, {1, 17, 1}, {17, 1, 17}, {3, 5, 7}, {64, 64, 64},
+        {33, 65, 17}, {100, 1, 100}, {1, 100, 100}, {128, 31, 64},
+    };
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        verify_rectangular_and_chain(shapes[s][0], shapes[s][1], shapes[s][2], &model, seed + s);
+    }
+    
+    int transpose_shapes[][2] = {{1, 1}, {3, 5}, {4, 4}, {7, 33}, {33, 7}, {36, 36}, {67, 67}, {100, 65}};
+    for (size_t s = 0; s < sizeof(transpose_shapes) / sizeof(transpose_shapes[0]); s++) {
+        verify_transposes(transpose_shapes[s][0], transpose_shapes[s][1], seed + s);
+    }
+    
+    verify_random_fills(seed);
+    verify_chain_planner(seed);
+    verify_large_product(512, seed);
+    
+    int update_shapes[][3] = {{3, 3, 3}, {64, 64, 64}, {100, 37, 81}};
+    for (size_t s = 0; s < sizeof(update_shapes) / sizeof(update_shapes[0]); s++) {
+        verify_incremental_updates(update_shapes[s][0], update_shapes[s][1], update_shapes[s][2], seed + s);
+    }
+    
+    printf("Verification: %d checks, %d failures\n", verify_checks, verify_failures);
+    return verify_failures;
+}
+
+int main(int argc, char **argv) {
+    unsigned long long seed = argc > 1 ? strtoull(argv[1], NULL, 10) : TEST_DEFAULT_SEED;
+    printf("Seed: %llu\n", seed);
+    return run_verification_suite(seed) == 0 ? 0 : 1;
+}